@@ -91,6 +91,10 @@ static void     update();
 static void     handle_input();
 static void     clear_screen();
 static void     game();
+static bool     camera_moved();
+static void     wait_for_event(Uint32 timeout);
+static void     report_idle();
+static void     print_stats(const char *label, Uint32 elapsed, clock_t cpu, Uint32 drawn, Uint32 waits, Uint32 idle);
 static void     cleanup();
 static void     init_shaders();
 static void     glPerspective(GLdouble fovy, GLdouble aspect, GLdouble zNear, GLdouble zFar);
@@ -192,6 +196,21 @@ static bool             sound = true;
 static Building         buildings[10][10];
 static Mix_Music*       steps;
 static int              probability = 20;
+static bool             dirty = true;
+static Vec2             drawnpos;
+static Vec2             drawnlook;
+static const Uint32     IDLE_TIMEOUT = 250;
+static const Uint32     REPORT_INTERVAL = 60000;
+static Uint32           frames_drawn = 0;
+static Uint32           idle_waits = 0;
+static Uint32           idle_ticks = 0;
+static Uint32           start_ticks = 0;
+static clock_t          start_clock = 0;
+static Uint32           report_ticks = 0;
+static clock_t          report_clock = 0;
+static Uint32           report_drawn = 0;
+static Uint32           report_waits = 0;
+static Uint32           report_idle_ticks = 0;
 
 static void draw_stuff() {
   draw_quad(.3f, Vec3(playerpos.x - 200, 0, playerpos.y - 200), Vec3(playerpos.x - 200, 0, playerpos.y + 200), Vec3(playerpos.x + 200, 0, playerpos.y + 200), Vec3(playerpos.x + 200, 0, playerpos.y - 200));
@@ -291,11 +310,14 @@ static void update() {
           doorpos.y = buildings[i][j].pos.y;
         }
         if(abs(playerpos.x - doorpos.x) < 1.0f && abs(playerpos.y - doorpos.y) < 1.0f) {
+          if(buildings[i][j].open != !buildings[i][j].locked)
+            dirty = true;
           buildings[i][j].open = !buildings[i][j].locked;
         }
       }
   }
   if(buildings[0][0].pos.x + 4.5 < playerpos.x - 75) {
+    dirty = true;
     for(int i = 1; i < 10; ++i)
       for(int j = 0; j < 10; ++j) {
         buildings[i - 1][j] = buildings[i][j];
@@ -318,6 +340,7 @@ static void update() {
     }
   }
   else if(buildings[9][9].pos.x - 4.5 > playerpos.x + 75) {
+    dirty = true;
     for(int i = 8; i > -1; i--)
       for(int j = 0; j < 10; ++j) {
         buildings[i + 1][j] = buildings[i][j];
@@ -340,6 +363,7 @@ static void update() {
     }
   }
   else if(buildings[0][0].pos.y + 4.5 < playerpos.y - 75) {
+    dirty = true;
     for(int i = 1; i < 10; ++i)
       for(int j = 0; j < 10; ++j) {
         buildings[j][i - 1] = buildings[j][i];
@@ -362,6 +386,7 @@ static void update() {
     }
   }
   else if(buildings[9][9].pos.y - 4.5 > playerpos.y + 75) {
+    dirty = true;
     for(int i = 8; i > -1; i--)
       for(int j = 0; j < 10; ++j) {
         buildings[j][i + 1] = buildings[j][i];
@@ -409,6 +434,11 @@ static void update() {
     acc.multiply(0.03f);
   playervel.multiply(0.85f);
   playervel.add(&acc);
+  // Settle the glide once it is too slow to see so the scene can go idle.
+  if(fabs(playervel.x) < 0.001f && fabs(playervel.y) < 0.001f)
+    playervel.zero();
+  else
+    dirty = true;
 
   if(playervel.x < .1 && playervel.y < .1)
     Mix_FadeOutMusic(50);
@@ -432,6 +462,9 @@ static void update() {
     }
   } */
 
+  if(camera_moved())
+    dirty = true;
+
   glPerspective(45.0f, (GLfloat) SCREEN_WIDTH / (GLfloat) SCREEN_HEIGHT, 0.1f, 100.0f);
   gluLookAt(playerpos.x, 2.0f, playerpos.y,
             playerpos.x + cos(look.x), 2.0f + sin(look.y) * 2, playerpos.y - sin(look.x),
@@ -457,6 +490,10 @@ static void handle_input() {
         mrel.y = event.motion.yrel;
         SDL_WarpMouse(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
         break;
+      case SDL_VIDEOEXPOSE:
+      case SDL_ACTIVEEVENT:
+        dirty = true;
+        break;
       case SDL_QUIT:
        running = false;
        break;
@@ -471,13 +508,78 @@ static void clear_screen() {
 }
 
 static void game() {
+  start_ticks = report_ticks = SDL_GetTicks();
+  start_clock = report_clock = clock();
   while(running) {
-    clear_screen();
-    draw_stuff();
-    SDL_GL_SwapBuffers();
     handle_input();
     update();
+    if(dirty) {
+      clear_screen();
+      draw_stuff();
+      SDL_GL_SwapBuffers();
+      drawnpos = playerpos;
+      drawnlook = look;
+      dirty = false;
+      ++frames_drawn;
+    }
+    else {
+      // Nothing changed since the last presented frame, so sleep until
+      // input arrives instead of redrawing the same picture.
+      ++idle_waits;
+      wait_for_event(IDLE_TIMEOUT);
+    }
+    if(SDL_GetTicks() - report_ticks >= REPORT_INTERVAL)
+      report_idle();
   }
+  print_stats("Total", SDL_GetTicks() - start_ticks, clock() - start_clock,
+              frames_drawn, idle_waits, idle_ticks);
+}
+
+static bool camera_moved() {
+  const float epsilon = 0.001f;
+  return fabs(playerpos.x - drawnpos.x) > epsilon || fabs(playerpos.y - drawnpos.y) > epsilon ||
+         fabs(look.x - drawnlook.x) > epsilon || fabs(look.y - drawnlook.y) > epsilon;
+}
+
+// SDL 1.2 has no SDL_WaitEventTimeout, so peek the queue and sleep the
+// same way SDL_WaitEvent does internally, giving up after timeout ms.
+// Events are left queued for handle_input().
+static void wait_for_event(Uint32 timeout) {
+  SDL_Event peek;
+  Uint32 start = SDL_GetTicks();
+  Uint32 now = start;
+  while(now - start < timeout) {
+    SDL_PumpEvents();
+    if(SDL_PeepEvents(&peek, 1, SDL_PEEKEVENT, SDL_ALLEVENTS) > 0)
+      break;
+    SDL_Delay(10);
+    now = SDL_GetTicks();
+  }
+  idle_ticks += now - start;
+}
+
+// Report only the window since the previous report, so a minute spent
+// standing still is not averaged in with earlier movement.
+static void report_idle() {
+  Uint32 now = SDL_GetTicks();
+  clock_t cpu = clock();
+  print_stats("Last interval", now - report_ticks, cpu - report_clock,
+              frames_drawn - report_drawn, idle_waits - report_waits,
+              idle_ticks - report_idle_ticks);
+  report_ticks = now;
+  report_clock = cpu;
+  report_drawn = frames_drawn;
+  report_waits = idle_waits;
+  report_idle_ticks = idle_ticks;
+}
+
+static void print_stats(const char *label, Uint32 elapsed, clock_t cpu, Uint32 drawn, Uint32 waits, Uint32 idle) {
+  if(elapsed == 0)
+    elapsed = 1;
+  printf("%s: %u frames drawn, %u idle waits; idle %.1f%% of %.1fs, cpu %.1f%%\n",
+         label, drawn, waits, 100.0f * idle / elapsed, elapsed / 1000.0f,
+         100.0f * cpu * 1000.0f / CLOCKS_PER_SEC / elapsed);
+  fflush(stdout);
 }
 
 static void cleanup() {